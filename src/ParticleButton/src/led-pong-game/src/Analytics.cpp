@@ -0,0 +1,163 @@
+#include "Display.h"
+#include "Statistics.h"
+#include "Analytics.h"
+
+// Local functions
+
+/**
+* Determines the index used to track a player's statistics.
+*
+* @param { LedSide } side - The side of the player
+*
+* @returns { int } The index of the player
+*/
+int playerIndex(LedSide side)
+{
+    return (side == LedSide::Maximum) ? 1 : 0;
+}
+
+// Class members
+
+/**
+* Initializes a new intance of the Analytics class.
+*/
+Analytics::Analytics()
+{
+    this->startSession(0);
+}
+
+/**
+* Begins a new session, discarding the statistics of any previous session.
+*
+* @param { unsigned long } now - The current time
+*/
+void Analytics::startSession(unsigned long now)
+{
+    for (int index = 0; index < ANALYTICS_PLAYER_COUNT; ++index)
+    {
+        this->reactionTimeMs[index].reset();
+
+        this->ledsLost[index]      = 0;
+        this->pings[index]         = 0;
+        this->halfEnteredAt[index] = now;
+        this->awaitingPing[index]  = false;
+    }
+
+    this->rallyLength.reset();
+
+    this->ballSide         = LedSide::Neither;
+    this->scoringRallies   = 0;
+    this->rallyPings       = 0;
+    this->sessionStartedAt = now;
+    this->sessionEndedAt   = now;
+}
+
+/**
+* Ends the current session, fixing the duration used for rate calculations.
+*
+* @param { unsigned long } now - The current time
+*/
+void Analytics::endSession(unsigned long now)
+{
+    this->sessionEndedAt = now;
+}
+
+/**
+* Records that the LED has advanced, noting when it enters a player's half.
+*
+* @param { LedSide }       side - The side that the LED is on after advancing
+* @param { unsigned long } now  - The current time
+*/
+void Analytics::recordAdvance(LedSide       side,
+                              unsigned long now)
+{
+    // The LED only changes sides by crossing the midpoint, so a change of side means that it has
+    // just entered the half of the player who now needs to ping it.  A ping reverses the LED within
+    // the same half, which is not a change.
+
+    if ((side != LedSide::Neither) && (side != this->ballSide))
+    {
+        auto index = playerIndex(side);
+
+        this->halfEnteredAt[index] = now;
+        this->awaitingPing[index]  = true;
+    }
+
+    this->ballSide = side;
+}
+
+/**
+* Records that a player pinged the LED back toward their opponent.
+*
+* @param { LedSide }       side - The side of the player that pinged the LED
+* @param { unsigned long } now  - The current time
+*/
+void Analytics::recordPing(LedSide       side,
+                           unsigned long now)
+{
+    if (side == LedSide::Neither)
+    {
+        return;
+    }
+
+    auto index = playerIndex(side);
+
+    if (this->awaitingPing[index])
+    {
+        this->reactionTimeMs[index].add(now - this->halfEnteredAt[index]);
+        this->awaitingPing[index] = false;
+    }
+
+    ++(this->pings[index]);
+    ++(this->rallyPings);
+}
+
+/**
+* Records that a player failed to ping the LED, ending the rally.
+*
+* @param { LedSide } side    - The side of the player that failed to ping the LED
+* @param { bool }    ledLost - true if the player lost a LED position; false if there was none left to lose
+*/
+void Analytics::recordLoss(LedSide side,
+                           bool    ledLost)
+{
+    // The rally that ends the game costs no LED position, so it does not count toward
+    // the LEDs lost per rally; only its length is counted.
+
+    if ((ledLost) && (side != LedSide::Neither))
+    {
+        ++(this->ledsLost[playerIndex(side)]);
+        ++(this->scoringRallies);
+    }
+
+    for (int index = 0; index < ANALYTICS_PLAYER_COUNT; ++index)
+    {
+        this->awaitingPing[index] = false;
+    }
+
+    this->rallyLength.add(this->rallyPings);
+    this->rallyPings = 0;
+}
+
+/**
+* Captures the session statistics for a player.
+*
+* @param { LedSide } side - The side of the player to summarize; Neither is treated as Minimum
+*
+* @returns { PlayerSummary } The statistics for the player
+*/
+PlayerSummary Analytics::summarize(LedSide side)
+{
+    auto index    = playerIndex(side);
+    auto duration = (this->sessionEndedAt - this->sessionStartedAt);
+
+    return PlayerSummary
+    {
+        this->reactionTimeMs[index].summarize(),
+        this->rallyLength.summarize(),
+        this->ledsLost[index],
+        (this->scoringRallies > 0) ? ((float)this->ledsLost[index] / this->scoringRallies) : 0,
+        this->pings[index],
+        (duration > 0) ? ((this->pings[index] * 1000.0f) / duration) : 0
+    };
+}
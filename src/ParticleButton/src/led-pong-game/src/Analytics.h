@@ -0,0 +1,101 @@
+#include "Display.h"
+#include "Statistics.h"
+
+#ifndef Analytics_H
+#define Analytics_H
+
+#define ANALYTICS_PLAYER_COUNT 2
+
+/**
+* The session statistics for a single player.  As a player loses at most one LED per rally,
+* LEDs lost are reported as a rate over the rallies that cost a LED rather than as a
+* distribution.
+*/
+struct PlayerSummary
+{
+    StatisticSummary reactionTimeMs;
+    StatisticSummary rallyLength;
+    unsigned long    ledsLost;
+    float            ledsLostPerRally;
+    unsigned long    pings;
+    float            pingsPerSecond;
+};
+
+/**
+* Gathers per-player statistics for a game session as events occur.  Each statistic is
+* maintained as a running summary, so memory use is fixed regardless of the length of the
+* session.  Times are supplied by the caller, in milliseconds.
+*/
+class Analytics
+{
+private:
+    RunningStatistic reactionTimeMs[ANALYTICS_PLAYER_COUNT];
+    RunningStatistic rallyLength;
+    unsigned long    ledsLost[ANALYTICS_PLAYER_COUNT];
+    unsigned long    scoringRallies;
+    unsigned long    pings[ANALYTICS_PLAYER_COUNT];
+    unsigned long    halfEnteredAt[ANALYTICS_PLAYER_COUNT];
+    bool             awaitingPing[ANALYTICS_PLAYER_COUNT];
+    LedSide          ballSide;
+    unsigned long    rallyPings;
+    unsigned long    sessionStartedAt;
+    unsigned long    sessionEndedAt;
+
+public:
+    /**
+    * Initializes a new intance of the Analytics class.
+    */
+    Analytics();
+
+    /**
+    * Begins a new session, discarding the statistics of any previous session.
+    *
+    * @param { unsigned long } now - The current time
+    */
+    void startSession(unsigned long now);
+
+    /**
+    * Ends the current session, fixing the duration used for rate calculations.
+    *
+    * @param { unsigned long } now - The current time
+    */
+    void endSession(unsigned long now);
+
+    /**
+    * Records that the LED has advanced, noting when it enters a player's half.
+    *
+    * @param { LedSide }       side - The side that the LED is on after advancing
+    * @param { unsigned long } now  - The current time
+    */
+    void recordAdvance(LedSide       side,
+                       unsigned long now);
+
+    /**
+    * Records that a player pinged the LED back toward their opponent.
+    *
+    * @param { LedSide }       side - The side of the player that pinged the LED
+    * @param { unsigned long } now  - The current time
+    */
+    void recordPing(LedSide       side,
+                    unsigned long now);
+
+    /**
+    * Records that a player failed to ping the LED, ending the rally.
+    *
+    * @param { LedSide } side    - The side of the player that failed to ping the LED
+    * @param { bool }    ledLost - true if the player lost a LED position; false if there was none left to lose
+    */
+    void recordLoss(LedSide side,
+                    bool    ledLost);
+
+    /**
+    * Captures the session statistics for a player.
+    *
+    * @param { LedSide } side - The side of the player to summarize; Neither is treated as Minimum
+    *
+    * @returns { PlayerSummary } The statistics for the player
+    */
+    PlayerSummary summarize(LedSide side);
+};
+
+#endif
@@ -1,44 +1,205 @@
 #include "BetterPhotonButton.h"
+#include "Mixer.h"
+#include "Effects.h"
 #include "Audio.h"
 #include <application.h>
+#include <stm32f2xx_dma.h>
+#include <stm32f2xx_gpio.h>
+#include <stm32f2xx_rcc.h>
+#include <stm32f2xx_tim.h>
 
 // Constants
 
-static const int WIN_EFFECT_NOTES [] =
-{
-    0,
-    50,
-    100,
-    200,
-    400,
-    800
-};
+#define AUDIO_BUFFER_HALF_LENGTH (AUDIO_BUFFER_LENGTH / 2)
+
+// The buzzer pin (PB7) is driven by channel 2 of TIM4, which runs from a 60 MHz clock.  Each PWM
+// period is one sample, so the sample rate is the timer clock divided by the prescaler and resolution.
+
+#define AUDIO_TIMER_CLOCK        60000000
+#define AUDIO_TIMER_PRESCALER    8
+#define AUDIO_PWM_RESOLUTION     (MIXER_OUTPUT_MAX + 1)
+
+static_assert(((AUDIO_TIMER_CLOCK / AUDIO_TIMER_PRESCALER / AUDIO_PWM_RESOLUTION) == AUDIO_SAMPLE_RATE), "The timer must consume samples at the rate that effects are rendered");
+
+// Globals
 
-static const int WIN_EFFECT_NOTES_LENGTH = (sizeof(WIN_EFFECT_NOTES) / sizeof(*WIN_EFFECT_NOTES));
+static Audio* activeAudio = NULL;
 
 /**
-* Initializes a new intance of the Display class.
+* Initializes a new intance of the Audio class.
 *
 * @param { BetterPhotonButton }  button - The internet button to use for emitting audio effects
 */
-Audio::Audio(BetterPhotonButton* button)
+Audio::Audio(BetterPhotonButton* button) : mixer(AUDIO_SAMPLE_RATE)
 {
     this->button         = button;
+    this->outputRunning  = false;
+    this->idleHalfCount  = 0;
     this->stopRequested  = false;
     this->winToneCurrent = 0;
 }
 
+/**
+* Handles the DMA interrupt raised when half of the sample buffer has been transferred,
+* rendering the next set of samples into the half that was just consumed.  Once the mixer
+* has been idle for both halves, the buffer holds only silence and output is stopped.
+*/
+void Audio::handleSampleTransfer()
+{
+    if (DMA_GetITStatus(DMA1_Stream6, DMA_IT_HTIF6) != RESET)
+    {
+        DMA_ClearITPendingBit(DMA1_Stream6, DMA_IT_HTIF6);
+        activeAudio->mixer.render(activeAudio->sampleBuffer, AUDIO_BUFFER_HALF_LENGTH);
+    }
+
+    if (DMA_GetITStatus(DMA1_Stream6, DMA_IT_TCIF6) != RESET)
+    {
+        DMA_ClearITPendingBit(DMA1_Stream6, DMA_IT_TCIF6);
+        activeAudio->mixer.render((activeAudio->sampleBuffer + AUDIO_BUFFER_HALF_LENGTH), AUDIO_BUFFER_HALF_LENGTH);
+    }
+
+    if (activeAudio->mixer.isPlaying())
+    {
+        activeAudio->idleHalfCount = 0;
+    }
+    else if (++(activeAudio->idleHalfCount) >= 2)
+    {
+        activeAudio->stopOutput();
+    }
+}
+
+/**
+* Starts streaming samples to the buzzer, if not already doing so.  The caller is
+* responsible for ensuring that the DMA interrupt cannot run concurrently.
+*/
+void Audio::startOutput()
+{
+    if (this->outputRunning)
+    {
+        return;
+    }
+
+    // Fill the whole buffer up front and restart the stream from its beginning, so that the
+    // first interrupt arrives after the first half has played.
+
+    this->mixer.render(this->sampleBuffer, AUDIO_BUFFER_LENGTH);
+    this->idleHalfCount = 0;
+
+    DMA_ClearFlag(DMA1_Stream6, (DMA_FLAG_TCIF6 | DMA_FLAG_HTIF6 | DMA_FLAG_TEIF6 | DMA_FLAG_DMEIF6 | DMA_FLAG_FEIF6));
+    DMA_SetCurrDataCounter(DMA1_Stream6, AUDIO_BUFFER_LENGTH);
+    DMA_Cmd(DMA1_Stream6, ENABLE);
+
+    TIM_SetCounter(TIM4, 0);
+    TIM_SelectOCxM(TIM4, TIM_Channel_2, TIM_OCMode_PWM1);
+    TIM_CCxCmd(TIM4, TIM_Channel_2, TIM_CCx_Enable);
+    TIM_Cmd(TIM4, ENABLE);
+
+    this->outputRunning = true;
+}
+
+/**
+* Stops streaming samples to the buzzer and drives the pin low.
+*/
+void Audio::stopOutput()
+{
+    TIM_Cmd(TIM4, DISABLE);
+    DMA_Cmd(DMA1_Stream6, DISABLE);
+
+    while (DMA_GetCmdStatus(DMA1_Stream6) != DISABLE)
+    {
+    }
+
+    // With the counter stopped, the output would hold whatever level it was last at;
+    // force it inactive so that the buzzer is left idle.
+
+    TIM_ForcedOC2Config(TIM4, TIM_ForcedAction_InActive);
+
+    this->outputRunning = false;
+}
+
+/**
+* Configures the timer and DMA stream used to drive the buzzer.  This must be called
+* once, during device setup, before any effects are played.
+*/
+void Audio::setup()
+{
+    activeAudio = this;
+
+    RCC_AHB1PeriphClockCmd(RCC_AHB1Periph_DMA1, ENABLE);
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM4, ENABLE);
+
+    // Route the buzzer pin to the timer output rather than using the firmware's tone() support, which
+    // claims the same timer but can only produce a single square wave.
+
+    pinMode(BUZZER_PHOTON_PIN, AF_OUTPUT_PUSHPULL);
+    GPIO_PinAFConfig(GPIOB, GPIO_PinSource7, GPIO_AF_TIM4);
+
+    TIM_TimeBaseInitTypeDef timeBase;
+    TIM_TimeBaseStructInit(&timeBase);
+
+    timeBase.TIM_Prescaler     = (AUDIO_TIMER_PRESCALER - 1);
+    timeBase.TIM_Period        = (AUDIO_PWM_RESOLUTION - 1);
+    timeBase.TIM_CounterMode   = TIM_CounterMode_Up;
+    timeBase.TIM_ClockDivision = TIM_CKD_DIV1;
+
+    TIM_TimeBaseInit(TIM4, &timeBase);
+
+    TIM_OCInitTypeDef outputCompare;
+    TIM_OCStructInit(&outputCompare);
+
+    outputCompare.TIM_OCMode      = TIM_OCMode_PWM1;
+    outputCompare.TIM_OutputState = TIM_OutputState_Enable;
+    outputCompare.TIM_OCPolarity  = TIM_OCPolarity_High;
+    outputCompare.TIM_Pulse       = MIXER_SILENCE;
+
+    TIM_OC2Init(TIM4, &outputCompare);
+    TIM_OC2PreloadConfig(TIM4, TIM_OCPreload_Enable);
+    TIM_ARRPreloadConfig(TIM4, ENABLE);
+
+    // Each timer update requests a transfer of the next sample into the compare register.  The stream
+    // runs circularly over the buffer, interrupting at the half and end so that the consumed half can
+    // be rendered while the other is playing.  Neither runs until an effect is played.
+
+    DMA_InitTypeDef dma;
+    DMA_StructInit(&dma);
+
+    dma.DMA_Channel            = DMA_Channel_2;
+    dma.DMA_PeripheralBaseAddr = (uint32_t)&(TIM4->CCR2);
+    dma.DMA_Memory0BaseAddr    = (uint32_t)this->sampleBuffer;
+    dma.DMA_DIR                = DMA_DIR_MemoryToPeripheral;
+    dma.DMA_BufferSize         = AUDIO_BUFFER_LENGTH;
+    dma.DMA_PeripheralInc      = DMA_PeripheralInc_Disable;
+    dma.DMA_MemoryInc          = DMA_MemoryInc_Enable;
+    dma.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+    dma.DMA_MemoryDataSize     = DMA_MemoryDataSize_HalfWord;
+    dma.DMA_Mode               = DMA_Mode_Circular;
+    dma.DMA_Priority           = DMA_Priority_High;
+
+    DMA_DeInit(DMA1_Stream6);
+    DMA_Init(DMA1_Stream6, &dma);
+    DMA_ITConfig(DMA1_Stream6, (DMA_IT_HT | DMA_IT_TC), ENABLE);
+
+    attachInterruptDirect(DMA1_Stream6_IRQn, &Audio::handleSampleTransfer);
+
+    TIM_DMACmd(TIM4, TIM_DMA_Update, ENABLE);
+    this->stopOutput();
+}
+
 /**
 * Plays the sound effect for when the LED is "pinged" back in the other
 * direction.
 */
 bool Audio::playPingEffect()
 {
-    // The API offered by the button library makes is difficult to do a short tone,
-    // so drop to the Partcle firmware for direct access.
-
     this->stopRequested = false;
-    tone(BUZZER_PHOTON_PIN, 254, 15);
+
+    // The mixer is also driven from the DMA interrupt; hold it off while the voices are modified.
+
+    ATOMIC_BLOCK()
+    {
+        startPingEffect(&(this->mixer));
+        this->startOutput();
+    }
 
     return false;
 }
@@ -48,11 +209,13 @@ bool Audio::playPingEffect()
 */
 bool Audio::playLossEffect()
 {
-    // The API offered by the button library makes is difficult to do a short tone,
-    // so drop to the Partcle firmware for direct access.
-
     this->stopRequested = false;
-    tone(BUZZER_PHOTON_PIN, 54, 50);
+
+    ATOMIC_BLOCK()
+    {
+        startLossEffect(&(this->mixer));
+        this->startOutput();
+    }
 
     return false;
 }
@@ -67,9 +230,14 @@ bool Audio::playWinEffect()
         this->stopRequested = false;
     }
 
-    if ((!this->stopRequested) && (this->winToneCurrent < (WIN_EFFECT_NOTES_LENGTH * 4)))
+    if ((!this->stopRequested) && (this->winToneCurrent < WIN_EFFECT_NOTE_COUNT))
     {
-        tone(BUZZER_PHOTON_PIN, WIN_EFFECT_NOTES[(this->winToneCurrent % WIN_EFFECT_NOTES_LENGTH)], 50);
+        ATOMIC_BLOCK()
+        {
+            startWinEffectNote(&(this->mixer), this->winToneCurrent);
+            this->startOutput();
+        }
+
         ++(this->winToneCurrent);
 
         return true;
@@ -87,4 +255,14 @@ bool Audio::playWinEffect()
 void Audio::stopAll()
 {
     this->stopRequested = true;
+
+    ATOMIC_BLOCK()
+    {
+        this->mixer.stopAll();
+
+        if (this->outputRunning)
+        {
+            this->stopOutput();
+        }
+    }
 }
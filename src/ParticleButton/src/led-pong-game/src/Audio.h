@@ -1,28 +1,62 @@
 #include "BetterPhotonButton.h"
+#include "Mixer.h"
 
 #ifndef Audio_H
 #define Audio_H
 
 #define BUZZER_PHOTON_PIN D0
 
+#define AUDIO_BUFFER_LENGTH 256
+
 /**
-* The audio artifacts and effects for the LED pong game.
+* The audio artifacts and effects for the LED pong game.  Effects are synthesized by a mixer into
+* a circular sample buffer which DMA streams to the PWM duty cycle of the buzzer pin; the buffer is
+* refilled a half at a time as DMA completes each half.  The timer and DMA only run while the mixer
+* has active voices, leaving the pin low otherwise.
 */
 class Audio
 {
 private:
     BetterPhotonButton* button;
+    Mixer               mixer;
+    uint16_t            sampleBuffer[AUDIO_BUFFER_LENGTH];
+    volatile bool       outputRunning;
+    int                 idleHalfCount;
     bool                stopRequested;
     int                 winToneCurrent;
 
+    /**
+    * Starts streaming samples to the buzzer, if not already doing so.  The caller is
+    * responsible for ensuring that the DMA interrupt cannot run concurrently.
+    */
+    void startOutput();
+
+    /**
+    * Stops streaming samples to the buzzer and drives the pin low.
+    */
+    void stopOutput();
+
+    /**
+    * Handles the DMA interrupt raised when half of the sample buffer has been transferred,
+    * rendering the next set of samples into the half that was just consumed.  Once the mixer
+    * has been idle for both halves, the buffer holds only silence and output is stopped.
+    */
+    static void handleSampleTransfer();
+
 public:
     /**
-    * Initializes a new intance of the Display class.
+    * Initializes a new intance of the Audio class.
     *
     * @param { BetterPhotonButton }  button - The internet button to use for emitting audio effects
     */
     Audio(BetterPhotonButton* button);
 
+    /**
+    * Configures the timer and DMA stream used to drive the buzzer.  This must be called
+    * once, during device setup, before any effects are played.
+    */
+    void setup();
+
     /**
     * Plays the sound effect for when the LED is "pinged" back in the other
     * direction.
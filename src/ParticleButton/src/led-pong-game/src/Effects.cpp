@@ -0,0 +1,56 @@
+#include "Mixer.h"
+#include "Effects.h"
+
+// Constants
+
+#define LOSS_EFFECT_DURATION_MS 350
+#define WIN_EFFECT_VOLUME       160
+#define WIN_EFFECT_REPETITIONS  4
+
+static const int WIN_EFFECT_NOTES [] =
+{
+    0,
+    50,
+    100,
+    200,
+    400,
+    800
+};
+
+static const int WIN_EFFECT_NOTES_LENGTH = (sizeof(WIN_EFFECT_NOTES) / sizeof(*WIN_EFFECT_NOTES));
+
+const int WIN_EFFECT_NOTE_COUNT = (WIN_EFFECT_NOTES_LENGTH * WIN_EFFECT_REPETITIONS);
+
+/**
+* Starts the sound effect for when the LED is "pinged" back in the other direction.
+*
+* @param { Mixer* } mixer - The mixer to play the effect on
+*/
+void startPingEffect(Mixer* mixer)
+{
+    mixer->playNote(Waveform::Sine, 254, 15);
+}
+
+/**
+* Starts the sound effect for when the game is lost.  The effect is a single note held for most
+* of the loss notification, so it should be started only once per loss.
+*
+* @param { Mixer* } mixer - The mixer to play the effect on
+*/
+void startLossEffect(Mixer* mixer)
+{
+    mixer->playNote(Waveform::Square, 54, LOSS_EFFECT_DURATION_MS);
+}
+
+/**
+* Starts a single note of the sound effect for when the game is won.  Notes ring longer than
+* a game tick, so starting one per tick overlaps each with those that came before it.
+*
+* @param { Mixer* } mixer - The mixer to play the effect on
+* @param { int }    note  - The index of the note to start, from 0 to WIN_EFFECT_NOTE_COUNT - 1
+*/
+void startWinEffectNote(Mixer* mixer,
+                        int    note)
+{
+    mixer->playNote(Waveform::Triangle, WIN_EFFECT_NOTES[(note % WIN_EFFECT_NOTES_LENGTH)], 50, WIN_EFFECT_VOLUME);
+}
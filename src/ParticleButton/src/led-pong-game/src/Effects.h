@@ -0,0 +1,42 @@
+#include "Mixer.h"
+
+#ifndef Effects_H
+#define Effects_H
+
+// The number of samples per second that effects are rendered at; this must match the rate at
+// which the buzzer consumes them.
+
+#define AUDIO_SAMPLE_RATE 29296
+
+/**
+* The number of notes in the win effect, each of which is started by a separate call
+* to startWinEffectNote.
+*/
+extern const int WIN_EFFECT_NOTE_COUNT;
+
+/**
+* Starts the sound effect for when the LED is "pinged" back in the other direction.
+*
+* @param { Mixer* } mixer - The mixer to play the effect on
+*/
+void startPingEffect(Mixer* mixer);
+
+/**
+* Starts the sound effect for when the game is lost.  The effect is a single note held for most
+* of the loss notification, so it should be started only once per loss.
+*
+* @param { Mixer* } mixer - The mixer to play the effect on
+*/
+void startLossEffect(Mixer* mixer);
+
+/**
+* Starts a single note of the sound effect for when the game is won.  Notes ring longer than
+* a game tick, so starting one per tick overlaps each with those that came before it.
+*
+* @param { Mixer* } mixer - The mixer to play the effect on
+* @param { int }    note  - The index of the note to start, from 0 to WIN_EFFECT_NOTE_COUNT - 1
+*/
+void startWinEffectNote(Mixer* mixer,
+                        int    note);
+
+#endif
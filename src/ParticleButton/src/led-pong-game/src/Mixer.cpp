@@ -0,0 +1,192 @@
+#include <stdint.h>
+#include <string.h>
+#include "Wavetable.h"
+#include "Mixer.h"
+
+// Constants
+
+#define FIXED_POINT_SHIFT 16
+#define MIX_SHIFT         9
+
+static const uint32_t PHASE_MASK = ((WAVETABLE_LENGTH << FIXED_POINT_SHIFT) - 1);
+
+// Local functions
+
+/**
+* Converts a span of time into a number of samples.
+*
+* @param { int }      milliseconds - The span of time to convert
+* @param { uint32_t } sampleRate   - The number of samples per second
+*
+* @returns { uint32_t } The number of samples that the span of time covers
+*/
+uint32_t millisecondsToSamples(int      milliseconds,
+                               uint32_t sampleRate)
+{
+    return (milliseconds > 0) ? (uint32_t)(((uint64_t)milliseconds * sampleRate) / 1000) : 0;
+}
+
+/**
+* Initializes a new intance of the Mixer class.
+*
+* @param { uint32_t } sampleRate - The number of samples per second that the mixer will render
+*/
+Mixer::Mixer(uint32_t sampleRate)
+{
+    this->sampleRate = sampleRate;
+    this->stopAll();
+}
+
+/**
+* Selects the voice to use for a new note, preferring an idle voice and otherwise
+* stealing the voice that is closest to completion.
+*/
+Voice* Mixer::allocateVoice()
+{
+    Voice*   candidate          = &(this->voices[0]);
+    uint32_t candidateRemaining = UINT32_MAX;
+
+    for (int index = 0; index < MIXER_VOICE_COUNT; ++index)
+    {
+        auto voice = &(this->voices[index]);
+
+        if (!voice->active)
+        {
+            return voice;
+        }
+
+        auto remaining = (voice->attackSamples + voice->sustainSamples + voice->releaseSamples);
+
+        if (remaining < candidateRemaining)
+        {
+            candidate          = voice;
+            candidateRemaining = remaining;
+        }
+    }
+
+    return candidate;
+}
+
+/**
+* Starts a note on the next available voice.  The note is shaped by a short attack and, once the
+* duration has elapsed, a release of MIXER_RELEASE_MS, allowing consecutive notes to overlap.
+*/
+bool Mixer::playNote(Waveform waveform,
+                     int      frequency,
+                     int      durationMs,
+                     int      volume)
+{
+    if ((frequency <= 0) || (durationMs <= 0) || (volume <= 0))
+    {
+        return false;
+    }
+
+    volume = (volume < MIXER_MAX_VOLUME) ? volume : MIXER_MAX_VOLUME;
+
+    // The attack is taken from the note's duration, with the remainder held at the peak volume.  All
+    // per-sample steps are calculated here so that rendering needs only additions and shifts.
+
+    auto peak           = ((uint32_t)volume << FIXED_POINT_SHIFT);
+    auto durationLength = millisecondsToSamples(durationMs, this->sampleRate);
+    auto attackLength   = millisecondsToSamples(MIXER_ATTACK_MS, this->sampleRate);
+    auto releaseLength  = millisecondsToSamples(MIXER_RELEASE_MS, this->sampleRate);
+
+    attackLength  = (attackLength < durationLength) ? attackLength : durationLength;
+    attackLength  = (attackLength > 0) ? attackLength : 1;
+    releaseLength = (releaseLength > 0) ? releaseLength : 1;
+
+    auto voice = this->allocateVoice();
+
+    voice->wavetable      = getWavetable(waveform);
+    voice->phase          = 0;
+    voice->phaseStep      = (uint32_t)((((uint64_t)frequency * WAVETABLE_LENGTH) << FIXED_POINT_SHIFT) / this->sampleRate);
+    voice->envelope       = 0;
+    voice->attackStep     = (peak / attackLength);
+    voice->releaseStep    = (peak / releaseLength);
+    voice->attackSamples  = attackLength;
+    voice->sustainSamples = (durationLength - attackLength);
+    voice->releaseSamples = releaseLength;
+    voice->active         = true;
+
+    return true;
+}
+
+/**
+* Determines whether any voice is currently active.
+*/
+bool Mixer::isPlaying()
+{
+    for (int index = 0; index < MIXER_VOICE_COUNT; ++index)
+    {
+        if (this->voices[index].active)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+* Silences all voices immediately.
+*/
+void Mixer::stopAll()
+{
+    memset(this->voices, 0, sizeof(this->voices));
+}
+
+/**
+* Renders the next set of samples for all active voices into a buffer.  Samples are widened to
+* 16 bits so that they may be transferred directly into a timer compare register.
+*/
+void Mixer::render(uint16_t* buffer,
+                   int       length)
+{
+    for (int sample = 0; sample < length; ++sample)
+    {
+        int32_t mixed = 0;
+
+        for (int index = 0; index < MIXER_VOICE_COUNT; ++index)
+        {
+            auto voice = &(this->voices[index]);
+
+            if (!voice->active)
+            {
+                continue;
+            }
+
+            // Advance the envelope through its stages.
+
+            if (voice->attackSamples)
+            {
+                voice->envelope += voice->attackStep;
+                --(voice->attackSamples);
+            }
+            else if (voice->sustainSamples)
+            {
+                --(voice->sustainSamples);
+            }
+            else if (voice->releaseSamples)
+            {
+                voice->envelope = (voice->envelope > voice->releaseStep) ? (voice->envelope - voice->releaseStep) : 0;
+                --(voice->releaseSamples);
+            }
+            else
+            {
+                voice->active = false;
+                continue;
+            }
+
+            mixed        += (voice->wavetable[(voice->phase >> FIXED_POINT_SHIFT)] * (int32_t)(voice->envelope >> FIXED_POINT_SHIFT));
+            voice->phase  = ((voice->phase + voice->phaseStep) & PHASE_MASK);
+        }
+
+        // Scale the mix so that two voices at full volume span the output range, clipping
+        // anything beyond it.
+
+        mixed = (MIXER_SILENCE + (mixed >> MIX_SHIFT));
+        mixed = (mixed < 0) ? 0 : ((mixed > MIXER_OUTPUT_MAX) ? MIXER_OUTPUT_MAX : mixed);
+
+        buffer[sample] = (uint16_t)mixed;
+    }
+}
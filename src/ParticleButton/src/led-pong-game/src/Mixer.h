@@ -0,0 +1,99 @@
+#include <stdint.h>
+#include "Wavetable.h"
+
+#ifndef Mixer_H
+#define Mixer_H
+
+#define MIXER_VOICE_COUNT  4
+#define MIXER_MAX_VOLUME   255
+#define MIXER_OUTPUT_MAX   255
+#define MIXER_SILENCE      128
+#define MIXER_ATTACK_MS    2
+#define MIXER_RELEASE_MS   30
+
+/**
+* The state of a single voice being synthesized by the mixer.  Phase and envelope values
+* are fixed-point, with the fractional part held in the lower 16 bits.
+*/
+struct Voice
+{
+    const int8_t* wavetable;
+    uint32_t      phase;
+    uint32_t      phaseStep;
+    uint32_t      envelope;
+    uint32_t      attackStep;
+    uint32_t      releaseStep;
+    uint32_t      attackSamples;
+    uint32_t      sustainSamples;
+    uint32_t      releaseSamples;
+    bool          active;
+};
+
+/**
+* Synthesizes and mixes a small number of voices from wavetables into a buffer of samples.  The
+* mixer has no dependency on the device firmware so that it can be exercised off-device; rendered
+* samples are unsigned 8-bit values centered on MIXER_SILENCE, suitable both for use as a PWM duty
+* cycle and as 8-bit PCM data in a WAV file.
+*/
+class Mixer
+{
+private:
+    Voice    voices[MIXER_VOICE_COUNT];
+    uint32_t sampleRate;
+
+    /**
+    * Selects the voice to use for a new note, preferring an idle voice and otherwise
+    * stealing the voice that is closest to completion.
+    *
+    * @returns { Voice* } The voice to use for the note
+    */
+    Voice* allocateVoice();
+
+public:
+    /**
+    * Initializes a new intance of the Mixer class.
+    *
+    * @param { uint32_t } sampleRate - The number of samples per second that the mixer will render
+    */
+    Mixer(uint32_t sampleRate);
+
+    /**
+    * Starts a note on the next available voice.  The note is shaped by a short attack and, once the
+    * duration has elapsed, a release of MIXER_RELEASE_MS, allowing consecutive notes to overlap.
+    *
+    * @param { Waveform } waveform   - The waveform to synthesize the note from
+    * @param { int }      frequency  - The frequency of the note, in Hz; a value of 0 is treated as a rest
+    * @param { int }      durationMs - The length of the note before it begins to release, in milliseconds
+    * @param { int }      volume     - The peak volume of the note, from 0 to MIXER_MAX_VOLUME; defaults to MIXER_MAX_VOLUME
+    *
+    * @returns { bool } true if a note was started; otherwise, false
+    */
+    bool playNote(Waveform waveform,
+                  int      frequency,
+                  int      durationMs,
+                  int      volume = MIXER_MAX_VOLUME);
+
+    /**
+    * Determines whether any voice is currently active.
+    *
+    * @returns { bool } true if at least one voice is active; otherwise, false
+    */
+    bool isPlaying();
+
+    /**
+    * Silences all voices immediately.
+    */
+    void stopAll();
+
+    /**
+    * Renders the next set of samples for all active voices into a buffer.  Samples are widened to
+    * 16 bits so that they may be transferred directly into a timer compare register.
+    *
+    * @param { uint16_t* } buffer - The buffer to render samples into
+    * @param { int }       length - The number of samples to render
+    */
+    void render(uint16_t* buffer,
+                int       length);
+};
+
+#endif
@@ -0,0 +1,317 @@
+#include <math.h>
+#include "Statistics.h"
+
+// Local functions
+
+/**
+* Sorts a small set of values in place, in ascending order.
+*
+* @param { float* } values - The values to sort
+* @param { int }    length - The number of values
+*/
+void sortValues(float* values,
+                int    length)
+{
+    for (int index = 1; index < length; ++index)
+    {
+        auto value    = values[index];
+        auto position = index;
+
+        while ((position > 0) && (values[position - 1] > value))
+        {
+            values[position] = values[position - 1];
+            --position;
+        }
+
+        values[position] = value;
+    }
+}
+
+// QuantileEstimator members
+
+/**
+* Initializes a new intance of the QuantileEstimator class.
+*
+* @param { float } quantile - The quantile to estimate, in the range (0, 1)
+*/
+QuantileEstimator::QuantileEstimator(float quantile)
+{
+    this->quantile = quantile;
+    this->reset();
+}
+
+/**
+* Places the markers at the observations held so far, once there are QUANTILE_EXACT_COUNT
+* of them.
+*/
+void QuantileEstimator::initializeMarkers()
+{
+    sortValues(this->observations, QUANTILE_EXACT_COUNT);
+
+    // Each marker is placed at the observation nearest its desired position, nudged where needed
+    // so that every marker has a distinct position with room for those that follow it.
+
+    for (int marker = 0; marker < QUANTILE_MARKER_COUNT; ++marker)
+    {
+        auto desired  = (1 + ((QUANTILE_EXACT_COUNT - 1) * this->increments[marker]));
+        auto position = roundf(desired);
+        auto lowest   = (marker > 0) ? (this->positions[marker - 1] + 1) : 1;
+        auto highest  = (float)(QUANTILE_EXACT_COUNT - (QUANTILE_MARKER_COUNT - 1 - marker));
+
+        position = (position < lowest)  ? lowest  : position;
+        position = (position > highest) ? highest : position;
+
+        this->desiredPositions[marker] = desired;
+        this->positions[marker]        = position;
+        this->heights[marker]          = this->observations[(int)position - 1];
+    }
+}
+
+/**
+* Calculates the adjusted height of a marker using piecewise-parabolic interpolation.
+*
+* @param { int } marker - The index of the marker to adjust
+* @param { int } sign   - The direction that the marker is moving; either 1 or -1
+*
+* @returns { float } The adjusted height of the marker
+*/
+float QuantileEstimator::parabolicHeight(int marker,
+                                         int sign)
+{
+    auto heights   = this->heights;
+    auto positions = this->positions;
+
+    auto nextSpan     = (positions[marker + 1] - positions[marker]);
+    auto previousSpan = (positions[marker] - positions[marker - 1]);
+
+    return heights[marker] + (sign / (positions[marker + 1] - positions[marker - 1])) *
+        ((((previousSpan + sign) * (heights[marker + 1] - heights[marker])) / nextSpan) +
+         (((nextSpan - sign) * (heights[marker] - heights[marker - 1])) / previousSpan));
+}
+
+/**
+* Calculates the adjusted height of a marker using linear interpolation.
+*
+* @param { int } marker - The index of the marker to adjust
+* @param { int } sign   - The direction that the marker is moving; either 1 or -1
+*
+* @returns { float } The adjusted height of the marker
+*/
+float QuantileEstimator::linearHeight(int marker,
+                                      int sign)
+{
+    return this->heights[marker] + sign * ((this->heights[marker + sign] - this->heights[marker]) / (this->positions[marker + sign] - this->positions[marker]));
+}
+
+/**
+* Adds an observation to the estimate.
+*
+* @param { float } value - The value observed
+*/
+void QuantileEstimator::add(float value)
+{
+    // Hold the first set of observations as-is.  Once the last arrives, they are used to place
+    // the markers.
+
+    if (this->count < QUANTILE_EXACT_COUNT)
+    {
+        this->observations[this->count++] = value;
+
+        if (this->count == QUANTILE_EXACT_COUNT)
+        {
+            this->initializeMarkers();
+        }
+
+        return;
+    }
+
+    // Find the cell that the observation falls into, extending the extreme markers if
+    // it falls outside of the range seen so far.
+
+    int cell;
+
+    if (value < this->heights[0])
+    {
+        this->heights[0] = value;
+        cell             = 0;
+    }
+    else if (value >= this->heights[QUANTILE_MARKER_COUNT - 1])
+    {
+        this->heights[QUANTILE_MARKER_COUNT - 1] = value;
+        cell                                     = (QUANTILE_MARKER_COUNT - 2);
+    }
+    else
+    {
+        for (cell = 0; cell < (QUANTILE_MARKER_COUNT - 2); ++cell)
+        {
+            if (value < this->heights[cell + 1])
+            {
+                break;
+            }
+        }
+    }
+
+    ++(this->count);
+
+    for (int marker = (cell + 1); marker < QUANTILE_MARKER_COUNT; ++marker)
+    {
+        ++(this->positions[marker]);
+    }
+
+    for (int marker = 0; marker < QUANTILE_MARKER_COUNT; ++marker)
+    {
+        this->desiredPositions[marker] += this->increments[marker];
+    }
+
+    // Move any interior marker that has drifted at least one position from where it should be,
+    // provided that doing so would not collide with its neighbor.
+
+    for (int marker = 1; marker < (QUANTILE_MARKER_COUNT - 1); ++marker)
+    {
+        auto drift = (this->desiredPositions[marker] - this->positions[marker]);
+
+        if (((drift >= 1) && ((this->positions[marker + 1] - this->positions[marker]) > 1)) ||
+            ((drift <= -1) && ((this->positions[marker - 1] - this->positions[marker]) < -1)))
+        {
+            auto sign   = (drift >= 0) ? 1 : -1;
+            auto height = this->parabolicHeight(marker, sign);
+
+            if ((height <= this->heights[marker - 1]) || (height >= this->heights[marker + 1]))
+            {
+                height = this->linearHeight(marker, sign);
+            }
+
+            this->heights[marker]    = height;
+            this->positions[marker] += sign;
+        }
+    }
+}
+
+/**
+* Retrieves the current estimate of the quantile.
+*
+* @returns { float } The estimated quantile; 0 if no observations have been added
+*/
+float QuantileEstimator::getEstimate()
+{
+    if (this->count == 0)
+    {
+        return 0;
+    }
+
+    // While every observation is still held, take the quantile directly from them.  This
+    // includes the point at which the markers were placed, as they have not yet moved.
+
+    if (this->count <= QUANTILE_EXACT_COUNT)
+    {
+        float values[QUANTILE_EXACT_COUNT];
+
+        for (unsigned long index = 0; index < this->count; ++index)
+        {
+            values[index] = this->observations[index];
+        }
+
+        sortValues(values, this->count);
+        return values[(int)roundf(this->quantile * (this->count - 1))];
+    }
+
+    return this->heights[QUANTILE_MARKER_COUNT / 2];
+}
+
+/**
+* Discards all observations, returning the estimator to its initial state.
+*/
+void QuantileEstimator::reset()
+{
+    auto quantile = this->quantile;
+
+    this->count = 0;
+
+    for (int marker = 0; marker < QUANTILE_MARKER_COUNT; ++marker)
+    {
+        this->heights[marker]          = 0;
+        this->positions[marker]        = 0;
+        this->desiredPositions[marker] = 0;
+    }
+
+    this->increments[0] = 0;
+    this->increments[1] = (quantile / 2);
+    this->increments[2] = quantile;
+    this->increments[3] = ((1 + quantile) / 2);
+    this->increments[4] = 1;
+}
+
+// RunningStatistic members
+
+/**
+* Initializes a new intance of the RunningStatistic class.
+*/
+RunningStatistic::RunningStatistic() : median(0.5), percentile90(0.9)
+{
+    this->reset();
+}
+
+/**
+* Adds an observation to the statistic.
+*
+* @param { float } value - The value observed
+*/
+void RunningStatistic::add(float value)
+{
+    // Use Welford's method to update the mean and variance, which avoids the loss of precision
+    // that accumulating a raw sum of squares would suffer.
+
+    ++(this->count);
+
+    auto delta = (value - this->mean);
+
+    this->mean                   += (delta / this->count);
+    this->sumOfSquaredDeviations += (delta * (value - this->mean));
+
+    if ((this->count == 1) || (value < this->minimum))
+    {
+        this->minimum = value;
+    }
+
+    if ((this->count == 1) || (value > this->maximum))
+    {
+        this->maximum = value;
+    }
+
+    this->median.add(value);
+    this->percentile90.add(value);
+}
+
+/**
+* Captures the current values of the statistic.
+*
+* @returns { StatisticSummary } The summary of the observations added so far
+*/
+StatisticSummary RunningStatistic::summarize()
+{
+    return StatisticSummary
+    {
+        this->count,
+        this->mean,
+        (this->count > 1) ? (this->sumOfSquaredDeviations / (this->count - 1)) : 0,
+        this->minimum,
+        this->maximum,
+        this->median.getEstimate(),
+        this->percentile90.getEstimate()
+    };
+}
+
+/**
+* Discards all observations, returning the statistic to its initial state.
+*/
+void RunningStatistic::reset()
+{
+    this->count                  = 0;
+    this->mean                   = 0;
+    this->sumOfSquaredDeviations = 0;
+    this->minimum                = 0;
+    this->maximum                = 0;
+
+    this->median.reset();
+    this->percentile90.reset();
+}
@@ -0,0 +1,136 @@
+#ifndef Statistics_H
+#define Statistics_H
+
+#define QUANTILE_MARKER_COUNT 5
+#define QUANTILE_EXACT_COUNT  32
+
+/**
+* A point-in-time view of the values tracked by a running statistic.
+*/
+struct StatisticSummary
+{
+    unsigned long count;
+    float         mean;
+    float         variance;
+    float         minimum;
+    float         maximum;
+    float         median;
+    float         percentile90;
+};
+
+/**
+* Estimates a single quantile of a stream of observations without storing all of them, using the
+* P-squared algorithm of Jain and Chlamtac.  The state is a fixed set of five markers whose
+* heights are adjusted as each observation arrives.  The first QUANTILE_EXACT_COUNT observations
+* are held as-is, so that short streams report the exact quantile and the markers start at the
+* positions that the quantile calls for.
+*/
+class QuantileEstimator
+{
+private:
+    float         quantile;
+    unsigned long count;
+    float         observations[QUANTILE_EXACT_COUNT];
+    float         heights[QUANTILE_MARKER_COUNT];
+    float         positions[QUANTILE_MARKER_COUNT];
+    float         desiredPositions[QUANTILE_MARKER_COUNT];
+    float         increments[QUANTILE_MARKER_COUNT];
+
+    /**
+    * Places the markers at the observations held so far, once there are QUANTILE_EXACT_COUNT
+    * of them.
+    */
+    void initializeMarkers();
+
+    /**
+    * Calculates the adjusted height of a marker using piecewise-parabolic interpolation.
+    *
+    * @param { int } marker - The index of the marker to adjust
+    * @param { int } sign   - The direction that the marker is moving; either 1 or -1
+    *
+    * @returns { float } The adjusted height of the marker
+    */
+    float parabolicHeight(int marker,
+                          int sign);
+
+    /**
+    * Calculates the adjusted height of a marker using linear interpolation.
+    *
+    * @param { int } marker - The index of the marker to adjust
+    * @param { int } sign   - The direction that the marker is moving; either 1 or -1
+    *
+    * @returns { float } The adjusted height of the marker
+    */
+    float linearHeight(int marker,
+                       int sign);
+
+public:
+    /**
+    * Initializes a new intance of the QuantileEstimator class.
+    *
+    * @param { float } quantile - The quantile to estimate, in the range (0, 1)
+    */
+    QuantileEstimator(float quantile);
+
+    /**
+    * Adds an observation to the estimate.
+    *
+    * @param { float } value - The value observed
+    */
+    void add(float value);
+
+    /**
+    * Retrieves the current estimate of the quantile.
+    *
+    * @returns { float } The estimated quantile; 0 if no observations have been added
+    */
+    float getEstimate();
+
+    /**
+    * Discards all observations, returning the estimator to its initial state.
+    */
+    void reset();
+};
+
+/**
+* Tracks the mean, variance, minimum, maximum, and approximate median and 90th percentile
+* of a stream of observations in a fixed amount of memory.
+*/
+class RunningStatistic
+{
+private:
+    unsigned long     count;
+    float             mean;
+    float             sumOfSquaredDeviations;
+    float             minimum;
+    float             maximum;
+    QuantileEstimator median;
+    QuantileEstimator percentile90;
+
+public:
+    /**
+    * Initializes a new intance of the RunningStatistic class.
+    */
+    RunningStatistic();
+
+    /**
+    * Adds an observation to the statistic.
+    *
+    * @param { float } value - The value observed
+    */
+    void add(float value);
+
+    /**
+    * Captures the current values of the statistic.
+    *
+    * @returns { StatisticSummary } The summary of the observations added so far
+    */
+    StatisticSummary summarize();
+
+    /**
+    * Discards all observations, returning the statistic to its initial state.
+    */
+    void reset();
+};
+
+#endif
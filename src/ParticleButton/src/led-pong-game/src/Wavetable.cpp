@@ -0,0 +1,63 @@
+#include <stdint.h>
+#include "Wavetable.h"
+
+// Constants
+
+static const int8_t SINE_WAVETABLE [WAVETABLE_LENGTH] =
+{
+       0,   12,   25,   37,   49,   60,   71,   81,
+      90,   98,  106,  112,  117,  122,  125,  126,
+     127,  126,  125,  122,  117,  112,  106,   98,
+      90,   81,   71,   60,   49,   37,   25,   12,
+       0,  -12,  -25,  -37,  -49,  -60,  -71,  -81,
+     -90,  -98, -106, -112, -117, -122, -125, -126,
+    -127, -126, -125, -122, -117, -112, -106,  -98,
+     -90,  -81,  -71,  -60,  -49,  -37,  -25,  -12
+};
+
+static const int8_t TRIANGLE_WAVETABLE [WAVETABLE_LENGTH] =
+{
+       0,    8,   16,   24,   32,   40,   48,   56,
+      64,   71,   79,   87,   95,  103,  111,  119,
+     127,  119,  111,  103,   95,   87,   79,   71,
+      64,   56,   48,   40,   32,   24,   16,    8,
+       0,   -8,  -16,  -24,  -32,  -40,  -48,  -56,
+     -64,  -71,  -79,  -87,  -95, -103, -111, -119,
+    -127, -119, -111, -103,  -95,  -87,  -79,  -71,
+     -64,  -56,  -48,  -40,  -32,  -24,  -16,   -8
+};
+
+static const int8_t SQUARE_WAVETABLE [WAVETABLE_LENGTH] =
+{
+     127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,
+     127,  127,  127,  127,  127,  127,  127,  127,
+    -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127,
+    -127, -127, -127, -127, -127, -127, -127, -127
+};
+
+/**
+* Retrieves the wavetable for a waveform.  Tables hold a single cycle of WAVETABLE_LENGTH signed
+* samples and are constant, allowing them to remain in flash rather than consuming RAM.
+*
+* @param { Waveform } waveform - The waveform to retrieve the table for
+*
+* @returns { const int8_t* } The table of samples for the requested waveform
+*/
+const int8_t* getWavetable(Waveform waveform)
+{
+    switch (waveform)
+    {
+        case Waveform::Triangle:
+            return TRIANGLE_WAVETABLE;
+
+        case Waveform::Square:
+            return SQUARE_WAVETABLE;
+
+        default:
+            return SINE_WAVETABLE;
+    }
+}
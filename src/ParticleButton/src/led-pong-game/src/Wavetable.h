@@ -0,0 +1,28 @@
+#include <stdint.h>
+
+#ifndef Wavetable_H
+#define Wavetable_H
+
+#define WAVETABLE_LENGTH 64
+
+/**
+* The shape of the wave that a voice is synthesized from.
+*/
+enum Waveform
+{
+    Sine     = 0,
+    Triangle = 1,
+    Square   = 2
+};
+
+/**
+* Retrieves the wavetable for a waveform.  Tables hold a single cycle of WAVETABLE_LENGTH signed
+* samples and are constant, allowing them to remain in flash rather than consuming RAM.
+*
+* @param { Waveform } waveform - The waveform to retrieve the table for
+*
+* @returns { const int8_t* } The table of samples for the requested waveform
+*/
+const int8_t* getWavetable(Waveform waveform);
+
+#endif
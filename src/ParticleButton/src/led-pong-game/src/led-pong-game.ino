@@ -3,6 +3,7 @@
 #include "HsiColor.h"
 #include "Display.h"
 #include "Audio.h"
+#include "Analytics.h"
 
 // Constants
 
@@ -39,11 +40,13 @@ struct GameState
 auto internetButton = BetterPhotonButton();
 auto display        = Display(&internetButton);
 auto audio          = Audio(&internetButton);
+auto analytics      = Analytics();
 auto gameState      = GameState { Activity::Idle, 0, 10, 25 };
 
 // Function signatures
 
 void buttonHandler(int button, bool pressed);
+void reportAnalytics(const char* player, PlayerSummary summary);
 
 /**
 * This function runs once, when the device is flashed or powered-on.  It is intended
@@ -54,6 +57,7 @@ void setup()
     internetButton.setup();
     internetButton.setReleasedHandler(&buttonHandler);
     display.clearLeds();
+    audio.setup();
 
     Serial.begin();
 }
@@ -76,18 +80,28 @@ void loop()
                 // If the LED animiation cannot advance, then it "hit" the limit and the player for that
                 // side loses a LED position.
 
-                if (!display.tickLedAdvance())
+                if (display.tickLedAdvance())
                 {
+                    analytics.recordAdvance(display.determineLedSide(display.getLedState()), millis());
+                }
+                else
+                {
+                    auto side = display.determineLedSide(display.getLedState());
+
                     // If we can no longer reduce the number of available LEDs, then the current player has lost the
-                    // game.  Advance the game state to showing the loss notification.
+                    // game.  Advance the game state to showing the loss notification.  The rally still ends, but
+                    // there was no LED left to lose.
 
                     if (!display.reduceAvailableLeds())
                     {
+                        analytics.recordLoss(side, false);
+
                         gameState.activity          = Activity::LossNotification;
                         gameState.activityTickCount = 0;
                     }
                     else
                     {
+                        analytics.recordLoss(side, true);
                         display.reverseLedDirection();
                     }
                 }
@@ -99,7 +113,7 @@ void loop()
             // If the state just transitioned, play the loss sound
             // effect.
 
-            if (gameState.activityTickCount)
+            if (gameState.activityTickCount == 0)
             {
                 audio.playLossEffect();
             }
@@ -134,6 +148,12 @@ void loop()
 
                 ++gameState.activityTickCount;
                 display.activateWinDisplay(side);
+
+                // The session is over; report the statistics gathered for each player.
+
+                analytics.endSession(millis());
+                reportAnalytics("Minimum", analytics.summarize(LedSide::Minimum));
+                reportAnalytics("Maximum", analytics.summarize(LedSide::Maximum));
             }
             else if (gameState.activityTickCount == 1)
             {
@@ -187,6 +207,7 @@ void buttonHandler(int  button,
             {
                 audio.stopAll();
                 display.reset();
+                analytics.startSession(millis());
             }
 
             return;
@@ -210,6 +231,38 @@ void buttonHandler(int  button,
         ((button == ButtonPosition::Left)  && (side == LedSide::Maximum) && (state.activeDirection == Direction::Forward)))
     {
         audio.playPingEffect();
+        analytics.recordPing(side, millis());
         display.reverseLedDirection();
     }
 }
+
+/**
+* Writes the session statistics for a player to the serial port.
+*
+* @param { const char* }   player  - The name of the player being reported
+* @param { PlayerSummary } summary - The statistics for the player
+*/
+void reportAnalytics(const char*   player,
+                     PlayerSummary summary)
+{
+    const StatisticSummary statistics [] = { summary.reactionTimeMs, summary.rallyLength };
+    const char*            names      [] = { "Reaction time (ms)", "Rally length" };
+
+    Serial.printlnf("%s player: %lu pings, %.2f pings per second", player, summary.pings, summary.pingsPerSecond);
+    Serial.printlnf("  LEDs lost: %lu, %.2f per rally", summary.ledsLost, summary.ledsLostPerRally);
+
+    for (auto index = 0; index < (int)(sizeof(statistics) / sizeof(*statistics)); ++index)
+    {
+        auto statistic = statistics[index];
+
+        Serial.printlnf("  %s: count=%lu mean=%.2f variance=%.2f min=%.2f max=%.2f median=%.2f p90=%.2f",
+            names[index],
+            statistic.count,
+            statistic.mean,
+            statistic.variance,
+            statistic.minimum,
+            statistic.maximum,
+            statistic.median,
+            statistic.percentile90);
+    }
+}
@@ -0,0 +1,263 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include "Mixer.h"
+#include "Effects.h"
+
+// Constants
+
+#define GAME_TICK_MS            15
+#define LOSS_NOTIFICATION_TICKS 25
+#define RENDER_CHUNK            128
+#define TAIL_SAMPLES            64
+
+// Type definitions
+
+typedef void (*EffectStarter)(Mixer* mixer);
+
+// Globals
+
+static int failureCount = 0;
+
+// Local functions
+
+/**
+* Records the outcome of a check, reporting it if it failed.
+*
+* @param { bool }        passed      - true if the check passed; otherwise, false
+* @param { const char* } description - A description of what was checked
+*/
+void check(bool        passed,
+           const char* description)
+{
+    if (!passed)
+    {
+        fprintf(stderr, "FAILED: %s\n", description);
+        ++failureCount;
+    }
+}
+
+/**
+* Renders samples from the mixer, appending them to a set of samples.
+*
+* @param { Mixer* }                  mixer   - The mixer to render from
+* @param { std::vector<uint16_t>& }  samples - The samples to append to
+* @param { uint32_t }                count   - The number of samples to render
+*/
+void renderSamples(Mixer*                 mixer,
+                   std::vector<uint16_t>& samples,
+                   uint32_t               count)
+{
+    uint16_t buffer[RENDER_CHUNK];
+
+    while (count > 0)
+    {
+        auto length = (count < RENDER_CHUNK) ? count : RENDER_CHUNK;
+
+        mixer->render(buffer, length);
+        samples.insert(samples.end(), buffer, (buffer + length));
+
+        count -= length;
+    }
+}
+
+/**
+* Renders samples from the mixer until all voices have finished, followed by a short tail.
+*
+* @param { Mixer* }                  mixer   - The mixer to render from
+* @param { std::vector<uint16_t>& }  samples - The samples to append to
+*/
+void renderUntilIdle(Mixer*                 mixer,
+                     std::vector<uint16_t>& samples)
+{
+    while (mixer->isPlaying())
+    {
+        renderSamples(mixer, samples, RENDER_CHUNK);
+    }
+
+    renderSamples(mixer, samples, TAIL_SAMPLES);
+}
+
+/**
+* Checks that none of a set of samples has been clipped to the limits of the output range.
+*
+* @param { const std::vector<uint16_t>& } samples     - The samples to check
+* @param { const char* }                  description - A description of what was checked
+*/
+void checkUnclipped(const std::vector<uint16_t>& samples,
+                    const char*                  description)
+{
+    auto clipped = 0;
+
+    for (auto sample : samples)
+    {
+        clipped += ((sample == 0) || (sample == MIXER_OUTPUT_MAX)) ? 1 : 0;
+    }
+
+    check((clipped == 0), description);
+}
+
+/**
+* Writes a set of samples to disk as an 8-bit mono WAV file.
+*
+* @param { const std::string& }           path    - The path of the file to write
+* @param { const std::vector<uint16_t>& } samples - The samples to write; each must fit in 8 bits
+*
+* @returns { bool } true if the file was written; otherwise, false
+*/
+bool writeWav(const std::string&           path,
+              const std::vector<uint16_t>& samples)
+{
+    auto file = fopen(path.c_str(), "wb");
+
+    if (!file)
+    {
+        return false;
+    }
+
+    auto writeUInt32 = [file](uint32_t value) { uint8_t bytes[] = { (uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24) }; fwrite(bytes, 1, 4, file); };
+    auto writeUInt16 = [file](uint16_t value) { uint8_t bytes[] = { (uint8_t)value, (uint8_t)(value >> 8) }; fwrite(bytes, 1, 2, file); };
+
+    uint32_t dataLength = samples.size();
+
+    fwrite("RIFF", 1, 4, file);
+    writeUInt32(36 + dataLength);
+    fwrite("WAVE", 1, 4, file);
+
+    fwrite("fmt ", 1, 4, file);
+    writeUInt32(16);
+    writeUInt16(1);
+    writeUInt16(1);
+    writeUInt32(AUDIO_SAMPLE_RATE);
+    writeUInt32(AUDIO_SAMPLE_RATE);
+    writeUInt16(1);
+    writeUInt16(8);
+
+    fwrite("data", 1, 4, file);
+    writeUInt32(dataLength);
+
+    for (auto sample : samples)
+    {
+        fputc((uint8_t)sample, file);
+    }
+
+    return (fclose(file) == 0);
+}
+
+/**
+* Renders a single-shot effect, checks that it returns to silence, and writes it to disk.
+*
+* @param { const std::string& } path    - The path of the WAV file to write
+* @param { EffectStarter }      starter - The function that starts the effect
+* @param { const char* }        name    - The name of the effect, for reporting
+*
+* @returns { std::vector<uint16_t> } The samples rendered for the effect
+*/
+std::vector<uint16_t> renderEffect(const std::string& path,
+                                   EffectStarter      starter,
+                                   const char*        name)
+{
+    auto mixer   = Mixer(AUDIO_SAMPLE_RATE);
+    auto samples = std::vector<uint16_t>();
+
+    starter(&mixer);
+    renderUntilIdle(&mixer, samples);
+
+    check((samples.back() == MIXER_SILENCE), name);
+    check(writeWav(path, samples), path.c_str());
+
+    return samples;
+}
+
+/**
+* Renders each of the game's audio effects to a WAV file, checking the rendered samples
+* along the way.
+*
+* @param { int }    argc - The number of command line arguments
+* @param { char** } argv - The command line arguments; the first, if present, is the directory to write to
+*
+* @returns { int } 0 if all checks passed; otherwise, 1
+*/
+int main(int    argc,
+         char** argv)
+{
+    auto directory = std::string((argc > 1) ? argv[1] : ".") + "/";
+
+    // With nothing playing, the mixer should produce only silence.
+
+    auto idleMixer   = Mixer(AUDIO_SAMPLE_RATE);
+    auto idleSamples = std::vector<uint16_t>();
+
+    renderSamples(&idleMixer, idleSamples, RENDER_CHUNK);
+
+    for (auto sample : idleSamples)
+    {
+        check((sample == MIXER_SILENCE), "idle mixer renders silence");
+    }
+
+    // The ping is a single note at full volume.  The mix is scaled so that two such voices span the
+    // output range, so one alone should be audible but reach no further than half of it.
+
+    auto pingSamples = renderEffect(directory + "ping.wav", &startPingEffect, "ping effect ends in silence");
+    auto pingPeak    = 0;
+
+    for (auto sample : pingSamples)
+    {
+        auto deviation = ((int)sample - MIXER_SILENCE);
+        deviation      = (deviation < 0) ? -deviation : deviation;
+        pingPeak       = (deviation > pingPeak) ? deviation : pingPeak;
+    }
+
+    check((pingPeak > 0), "ping effect is audible");
+    check((pingPeak <= ((MIXER_OUTPUT_MAX - MIXER_SILENCE + 1) / 2)), "ping effect peak is bounded by a single voice");
+
+    // The loss effect is started on the first tick of the loss notification, as the game loop does,
+    // and rendered through the rest of the notification.
+
+    auto tickLength  = (uint32_t)((AUDIO_SAMPLE_RATE * GAME_TICK_MS) / 1000);
+    auto lossMixer   = Mixer(AUDIO_SAMPLE_RATE);
+    auto lossSamples = std::vector<uint16_t>();
+
+    for (auto tick = 0; tick < LOSS_NOTIFICATION_TICKS; ++tick)
+    {
+        if (tick == 0)
+        {
+            startLossEffect(&lossMixer);
+        }
+
+        renderSamples(&lossMixer, lossSamples, tickLength);
+    }
+
+    renderUntilIdle(&lossMixer, lossSamples);
+
+    checkUnclipped(lossSamples, "loss effect is not clipped");
+    check((lossSamples.back() == MIXER_SILENCE), "loss effect ends in silence");
+    check(writeWav((directory + "loss.wav"), lossSamples), "loss.wav");
+
+    // The win effect starts a note per game tick, as the game loop does.
+
+    auto winMixer   = Mixer(AUDIO_SAMPLE_RATE);
+    auto winSamples = std::vector<uint16_t>();
+
+    for (auto note = 0; note < WIN_EFFECT_NOTE_COUNT; ++note)
+    {
+        startWinEffectNote(&winMixer, note);
+        renderSamples(&winMixer, winSamples, tickLength);
+    }
+
+    renderUntilIdle(&winMixer, winSamples);
+
+    checkUnclipped(winSamples, "win effect is not clipped");
+    check((winSamples.back() == MIXER_SILENCE), "win effect ends in silence");
+    check(writeWav((directory + "win.wav"), winSamples), "win.wav");
+
+    if (failureCount > 0)
+    {
+        fprintf(stderr, "%d check(s) failed\n", failureCount);
+        return 1;
+    }
+
+    printf("Rendered ping.wav, loss.wav, and win.wav at %d Hz to %s\n", AUDIO_SAMPLE_RATE, directory.c_str());
+    return 0;
+}
@@ -0,0 +1,260 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <algorithm>
+#include <vector>
+#include "Statistics.h"
+
+// Constants
+
+#define MOMENT_TOLERANCE        0.001
+#define LONG_STREAM_LENGTH      10000
+#define LONG_STREAM_RANK_ERROR  0.02
+#define SHORT_STREAM_LENGTH     100
+#define SHORT_STREAM_TRIALS     100
+#define SHORT_STREAM_RANK_ERROR 0.03
+
+// Type definitions
+
+typedef float (*Distribution)(uint32_t* state);
+
+// Globals
+
+static int failureCount = 0;
+
+// Local functions
+
+/**
+* Records the outcome of a check, reporting it if it failed.
+*
+* @param { bool }        passed      - true if the check passed; otherwise, false
+* @param { const char* } description - A description of what was checked
+* @param { int }         length      - The number of observations that the check was made over
+*/
+void check(bool        passed,
+           const char* description,
+           int         length)
+{
+    if (!passed)
+    {
+        fprintf(stderr, "FAILED: %s (%d observations)\n", description, length);
+        ++failureCount;
+    }
+}
+
+/**
+* Generates the next value of a simple xorshift sequence, so that runs are repeatable
+* regardless of the platform's random number generator.
+*
+* @param { uint32_t* } state - The state of the sequence; must not be 0
+*
+* @returns { uint32_t } The next value in the sequence
+*/
+uint32_t nextRandom(uint32_t* state)
+{
+    *state ^= (*state << 13);
+    *state ^= (*state >> 17);
+    *state ^= (*state << 5);
+
+    return *state;
+}
+
+/**
+* Produces a whole number spread evenly between 0 and 999.
+*
+* @param { uint32_t* } state - The state of the random sequence
+*
+* @returns { float } The value produced
+*/
+float uniformValue(uint32_t* state)
+{
+    return (float)(nextRandom(state) % 1000);
+}
+
+/**
+* Produces a value shaped like a reaction time: bunched near a floor, with a long tail
+* of slower responses.
+*
+* @param { uint32_t* } state - The state of the random sequence
+*
+* @returns { float } The value produced
+*/
+float reactionValue(uint32_t* state)
+{
+    auto unit = ((nextRandom(state) + 1.0) / 4294967297.0);
+    return (float)(150 - (120 * log(unit)));
+}
+
+/**
+* Determines the exact quantile of a set of sorted values, using the same nearest-rank
+* rule as the estimator.
+*
+* @param { const std::vector<float>& } sorted   - The values, in ascending order
+* @param { float }                     quantile - The quantile to find
+*
+* @returns { float } The value at the quantile
+*/
+float exactQuantile(const std::vector<float>& sorted,
+                    float                     quantile)
+{
+    return sorted[(int)roundf(quantile * (sorted.size() - 1))];
+}
+
+/**
+* Determines the fraction of a set of sorted values that fall below an estimate, counting
+* values equal to it as half below.
+*
+* @param { const std::vector<float>& } sorted   - The values, in ascending order
+* @param { float }                     estimate - The estimated quantile
+*
+* @returns { double } The rank of the estimate, from 0 to 1
+*/
+double rankOf(const std::vector<float>& sorted,
+              float                     estimate)
+{
+    auto below  = (std::lower_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin());
+    auto atMost = (std::upper_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin());
+
+    return ((below + atMost) / 2.0) / sorted.size();
+}
+
+/**
+* Adds a stream of values to a statistic, retaining a sorted copy for comparison.
+*
+* @param { RunningStatistic* } statistic    - The statistic to add to
+* @param { Distribution }      distribution - The source of values
+* @param { uint32_t }          seed         - The seed for the random sequence; must not be 0
+* @param { int }               length       - The number of values to add
+*
+* @returns { std::vector<float> } The values added, in ascending order
+*/
+std::vector<float> addStream(RunningStatistic* statistic,
+                             Distribution      distribution,
+                             uint32_t          seed,
+                             int               length)
+{
+    auto values = std::vector<float>();
+    auto state  = seed;
+
+    statistic->reset();
+
+    for (auto index = 0; index < length; ++index)
+    {
+        auto value = distribution(&state);
+
+        statistic->add(value);
+        values.push_back(value);
+    }
+
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+/**
+* Checks the count, mean, variance, minimum, and maximum of a statistic against values
+* calculated directly in double precision.
+*
+* @param { StatisticSummary }          summary - The summary to check
+* @param { const std::vector<float>& } sorted  - The values that were added, in ascending order
+*/
+void checkMoments(StatisticSummary          summary,
+                  const std::vector<float>& sorted)
+{
+    auto length = (int)sorted.size();
+    auto sum    = 0.0;
+
+    for (auto value : sorted)
+    {
+        sum += value;
+    }
+
+    auto mean    = (sum / length);
+    auto squares = 0.0;
+
+    for (auto value : sorted)
+    {
+        squares += ((value - mean) * (value - mean));
+    }
+
+    auto variance = (length > 1) ? (squares / (length - 1)) : 0.0;
+
+    check((summary.count == (unsigned long)length), "count matches", length);
+    check((fabs(summary.mean - mean) <= (MOMENT_TOLERANCE * (fabs(mean) + 1))), "mean matches", length);
+    check((fabs(summary.variance - variance) <= (MOMENT_TOLERANCE * (variance + 1))), "variance matches", length);
+    check((summary.minimum == sorted.front()), "minimum matches", length);
+    check((summary.maximum == sorted.back()), "maximum matches", length);
+}
+
+/**
+* Checks the running statistic against values calculated directly from the stream, writing
+* a report of the checks that failed.
+*
+* @returns { int } 0 if all checks passed; otherwise, 1
+*/
+int main()
+{
+    auto statistic     = RunningStatistic();
+    auto distributions = { &uniformValue, &reactionValue };
+
+    // An empty statistic reports zeros rather than stale or uninitialized values.
+
+    auto empty = statistic.summarize();
+
+    check(((empty.count == 0) && (empty.mean == 0) && (empty.variance == 0) && (empty.median == 0) && (empty.percentile90 == 0)), "empty statistic is zero", 0);
+
+    // While every observation is still held, the quantiles must be exact; this includes the
+    // point at which the estimator's markers are placed.
+
+    for (auto distribution : distributions)
+    {
+        for (auto length = 1; length <= QUANTILE_EXACT_COUNT; ++length)
+        {
+            auto sorted  = addStream(&statistic, distribution, length, length);
+            auto summary = statistic.summarize();
+
+            checkMoments(summary, sorted);
+            check((summary.median == exactQuantile(sorted, 0.5)), "median is exact", length);
+            check((summary.percentile90 == exactQuantile(sorted, 0.9)), "90th percentile is exact", length);
+        }
+    }
+
+    // Once estimation takes over, the estimates should rank close to the quantile that they
+    // stand for; short streams are judged on average, as any single one may land between
+    // widely spaced values.
+
+    for (auto distribution : distributions)
+    {
+        auto medianError       = 0.0;
+        auto percentile90Error = 0.0;
+
+        for (auto trial = 1; trial <= SHORT_STREAM_TRIALS; ++trial)
+        {
+            auto sorted  = addStream(&statistic, distribution, trial, SHORT_STREAM_LENGTH);
+            auto summary = statistic.summarize();
+
+            checkMoments(summary, sorted);
+
+            medianError       += (fabs(rankOf(sorted, summary.median) - 0.5) / SHORT_STREAM_TRIALS);
+            percentile90Error += (fabs(rankOf(sorted, summary.percentile90) - 0.9) / SHORT_STREAM_TRIALS);
+        }
+
+        check((medianError <= SHORT_STREAM_RANK_ERROR), "median rank is close on average", SHORT_STREAM_LENGTH);
+        check((percentile90Error <= SHORT_STREAM_RANK_ERROR), "90th percentile rank is close on average", SHORT_STREAM_LENGTH);
+
+        auto sorted  = addStream(&statistic, distribution, 1, LONG_STREAM_LENGTH);
+        auto summary = statistic.summarize();
+
+        checkMoments(summary, sorted);
+        check((fabs(rankOf(sorted, summary.median) - 0.5) <= LONG_STREAM_RANK_ERROR), "median rank is close", LONG_STREAM_LENGTH);
+        check((fabs(rankOf(sorted, summary.percentile90) - 0.9) <= LONG_STREAM_RANK_ERROR), "90th percentile rank is close", LONG_STREAM_LENGTH);
+    }
+
+    if (failureCount > 0)
+    {
+        fprintf(stderr, "%d check(s) failed\n", failureCount);
+        return 1;
+    }
+
+    printf("All statistics checks passed\n");
+    return 0;
+}